@@ -0,0 +1,40 @@
+/*
+   Walker/Vose alias table for O(1) sampling of a discrete distribution.
+   Built once from a list of non-negative weights; each sample then costs
+   one table lookup and one comparison instead of a CDF search.
+*/
+
+#ifndef ALIASTABLE_H
+#define ALIASTABLE_H
+
+// C++ libraries
+#include <vector>
+#include <stdint.h>
+
+class AliasTable
+{
+ public:
+  AliasTable();
+
+  // build from n weights, returns false if they are all zero or negative
+  bool Build(const double *weights, long n);
+
+  // pick an index from two uniform numbers in [0,1)
+  long Sample(double u1, double u2) const
+  {
+    long i = (long)(u1 * fN);
+    if (i >= fN) i = fN - 1;
+    return (u2 < fProb[i]) ? i : (long)fAlias[i];
+  }
+
+  long GetN() const { return fN; }
+  double GetTotal() const { return fTotal; }
+
+ private:
+  long fN;
+  double fTotal;               // sum of weights
+  std::vector<double> fProb;   // probability of keeping index i
+  std::vector<uint32_t> fAlias; // index used otherwise
+};
+
+#endif
@@ -0,0 +1,101 @@
+/*
+   Event list output and input.
+
+   Text files keep the original rndmSample layout: a header line of column
+   names, then one tab separated row per event printed with %f. Binary
+   files start with a fixed 128 byte EventFileHeader followed by one row
+   of float32 values per event, in column order.
+
+   Encoding is separate from writing so worker threads can format their
+   blocks in parallel while the file is written in block order. The
+   reader streams either kind of file back in chunks of events.
+*/
+
+#ifndef EVENTFILE_H
+#define EVENTFILE_H
+
+// C++ libraries
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+// binary file header, written as is (native little endian)
+struct EventFileHeader
+{
+  char     magic[8];        // "EVGNEVT"
+  uint32_t version;         // kEventFileVersion
+  uint32_t ncols;           // number of float32 columns per event
+  uint64_t nevents;         // number of events in file
+  uint64_t seed;            // seed used to generate the sample
+  char     names[6][16];    // column names, zero padded
+};
+
+const uint32_t kEventFileVersion = 1;
+const int kEventFileMaxCols = 6;
+
+class EventFileWriter
+{
+ public:
+  EventFileWriter();
+  ~EventFileWriter();
+
+  // open output file and write its header, returns false on failure
+  bool Open(const char *path, bool binary, const std::vector<std::string> &columns,
+	    uint64_t nevents, uint64_t seed);
+
+  // encode n events given as one array per column into buf,
+  // does no I/O so it is safe to call from several threads
+  void Encode(const double *const *cols, long n, std::string &buf) const;
+
+  // append an encoded block
+  bool Write(const std::string &buf);
+
+  // flush and close, returns false if anything still buffered could not
+  // be written
+  bool Close();
+
+ private:
+  FILE *fFile;
+  bool fBinary;
+  int fNcols;
+  std::vector<char> fBuffer;  // stdio buffer for large sequential writes
+};
+
+class EventFileReader
+{
+ public:
+  EventFileReader();
+  ~EventFileReader();
+
+  // open a text or binary event file and read its header
+  bool Open(const char *path);
+
+  int GetNcols() const { return fColumns.size(); }
+  const std::vector<std::string> &GetColumns() const { return fColumns; }
+
+  // index of a named column, -1 if the file has none
+  int FindColumn(const std::string &name) const;
+
+  // number of events, from the header of binary files, -1 for text
+  long long GetNevents() const { return fNevents; }
+  uint64_t GetSeed() const { return fSeed; }
+  bool IsBinary() const { return fBinary; }
+
+  // read up to n events into rows, GetNcols() values per event,
+  // returns the number read (0 at the end of the file, -1 on error)
+  long Read(long n, std::vector<double> &rows);
+
+  void Close();
+
+ private:
+  FILE *fFile;
+  bool fBinary;
+  long long fNevents;
+  uint64_t fSeed;
+  std::vector<std::string> fColumns;
+  std::vector<float> fRow;    // binary read buffer
+  std::vector<char> fBuffer;  // stdio buffer for large sequential reads
+};
+
+#endif
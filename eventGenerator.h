@@ -0,0 +1,110 @@
+/*
+   Embeddable event generator.
+
+   Wraps the alias table sampler of rndmSample for use inside another
+   program: set it up once from fluxW, a cross section grid file or a
+   cross section cube, then pull events in batches of separate arrays per
+   quantity, or have them passed to a callback batch by batch.
+
+   Every generator owns its random stream and nothing else is mutable.
+   Generators can't be copied, since a copy would repeat the events of the
+   original; Clone(stream) gives a generator sharing the sampling tables
+   with the same seed but its own stream, to hand to another thread. No
+   locks are taken while generating.
+
+   With seed and stream = block number, a generator gives the same E_e,
+   cos_theta (and E_v) as that block of rndmSample with the same seed.
+   Azimuth angles come from a separate stream and don't change that.
+
+   Built into libevgen.a / libevgen.so with make lib.
+*/
+
+#ifndef EVENTGENERATOR_H
+#define EVENTGENERATOR_H
+
+// C++ libraries
+#include <functional>
+#include <memory>
+#include <vector>
+#include <stdint.h>
+
+// local libraries
+#include "rndmStream.h"
+
+class TH1D;
+class TH2D;
+class EventSampler;
+class XsecCube;
+
+// one batch of events, one array per quantity. E_v is only filled by
+// generators that sample E_v (joint set up), phi only with SetAzimuth
+struct EventBatch
+{
+  long n;                          // number of events in the batch
+  std::vector<double> E_e;         // electron kinetic energy (MeV)
+  std::vector<double> cos_theta;   // cos of angle to the neutrino direction
+  std::vector<double> E_v;         // neutrino energy (MeV)
+  std::vector<double> phi;         // azimuth around the neutrino direction, [0, 2pi)
+
+  EventBatch() : n(0) {}
+};
+
+class EventGenerator
+{
+ public:
+  typedef std::function<void(const EventBatch&)> Callback;
+
+  EventGenerator(uint64_t seed = 0, uint64_t stream = 0);
+  EventGenerator(EventGenerator&&) = default;
+  EventGenerator &operator=(EventGenerator&&) = default;
+  EventGenerator(const EventGenerator&) = delete;
+  EventGenerator &operator=(const EventGenerator&) = delete;
+
+  // generator with the same tables, seed and options on another stream,
+  // eg one per worker thread with stream = thread number
+  EventGenerator Clone(uint64_t stream) const;
+
+  // sample (E_e, cos_theta) from the bins of a flux weighted histo
+  bool Init(const TH2D *fluxW);
+
+  // read fluxW from a ROOT file, gDirectory is left where it was
+  bool Init(const char *rootName, const char *histName = "fluxW");
+
+  // sample (E_v, E_e, cos_theta) from cube slices weighted by flux per
+  // slice, fluxW gives the axes (see EventSampler)
+  bool Init(const XsecCube &cube, const double *flux, const TH2D *fluxW);
+
+  // sample (E_v, E_e, cos_theta) for flux (SNS flux if 0) from the cross
+  // sections of a grid file made by gridConvert, using the interpolated
+  // slices if the grid has them and interpolating the tabulated ones if not.
+  // books nothing in gDirectory
+  bool InitGrid(const char *gridName, TH1D *flux = 0);
+
+  bool IsReady() const { return (bool)fSampler; }
+  bool HasEnu() const;
+
+  // select random stream, generators with different streams are independent
+  void SetSeed(uint64_t seed, uint64_t stream = 0);
+
+  // also generate uniform azimuth angles
+  void SetAzimuth(bool on) { fAzimuth = on; }
+
+  // next n events into batch, arrays are resized to n
+  void Generate(long n, EventBatch &batch);
+
+  // next n events into caller arrays, E_v and phi may be 0 if not wanted
+  void Generate(long n, double *E_e, double *cos_theta, double *E_v = 0, double *phi = 0);
+
+  // next n events passed to callback in batches of up to batchSize
+  void Generate(long n, const Callback &callback, long batchSize = 4096);
+
+ private:
+  std::shared_ptr<const EventSampler> fSampler;  // shared by clones
+  uint64_t fSeed;
+  RndmStream fRng;
+  RndmStream fPhiRng;
+  bool fAzimuth;
+  std::vector<double> fScratch;  // bins of joint events
+};
+
+#endif
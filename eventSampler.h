@@ -0,0 +1,67 @@
+/*
+   Fast sampler for the flux weighted (E_e, cos_theta) distribution.
+
+   Builds an alias table over the bins of fluxW once, then draws each event
+   as one O(1) bin pick plus a uniform position inside the bin, the same
+   distribution TH2::GetRandom2 samples. The sampler itself holds no random
+   state, so one instance can be shared by any number of threads each
+   driving its own RndmStream.
+
+   Initialized from a cross section cube and the flux per slice instead,
+   it samples the joint (E_v, E_e, cos_theta) distribution whose E_v sum
+   is fluxW: an alias table over slices picks E_v, then an alias table
+   over the E_e, cos_theta bins of that slice picks the bin. Each event
+   then also knows its E_v slice and bin, which is what reweighting needs.
+*/
+
+#ifndef EVENTSAMPLER_H
+#define EVENTSAMPLER_H
+
+// C++ libraries
+#include <vector>
+
+// local libraries
+#include "aliasTable.h"
+#include "rndmStream.h"
+
+class TH2D;
+class XsecCube;
+
+class EventSampler
+{
+ public:
+  EventSampler();
+
+  // build alias table from the bins of a flux weighted histo
+  bool Init(const TH2D *fluxW);
+
+  // build slice and bin tables for the joint distribution, weights
+  // xsec[v][bin] * flux[v] * binsize[v]. axes are taken from fluxW, which
+  // must have the E_e bins of the cube
+  bool Init(const XsecCube &cube, const double *flux, const TH2D *fluxW);
+  bool IsJoint() const { return !fSliceTables.empty(); }
+
+  // draw n events into E_e and cos_theta, using 4 numbers per event
+  void Sample(RndmStream &rng, long n, double *E_e, double *cos_theta) const;
+
+  // draw n events from the joint distribution (joint Init only), also
+  // giving E_v of the slice and the x and y bin numbers (from 1) of each
+  // event, using 6 numbers per event
+  void Sample(RndmStream &rng, long n, double *E_e, double *cos_theta,
+	      double *E_v, double *xbin, double *ybin) const;
+
+  const AliasTable &GetTable() const { return fTable; }
+
+ private:
+  void SetAxes(const TH2D *fluxW);
+
+  AliasTable fTable;                     // bins, or slices for joint
+  std::vector<AliasTable> fSliceTables;  // bins of each slice
+  std::vector<int> fSliceNkept;          // E_e bins kept per row of each slice
+  std::vector<double> fEnu;              // E_v of each slice
+  int fNbinsX, fNbinsY;
+  double fXmin, fXwidth;
+  double fYmin, fYwidth;
+};
+
+#endif
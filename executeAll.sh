@@ -11,11 +11,8 @@ echo "\nScraping..."
 echo "\nCompiling...\n"
 make all -s
 
-# run diff2poly for each file in infiles
-foreach filename (./infiles/*.txt)
-    echo "Reading $filename:t"
-    ./diff2poly $filename:t
-end
+# run diff2poly once over all files in infiles
+./diff2poly --all ./infiles/
 
 # interpolate to get histo every .1 MeV
 echo "\nInterpolating..."
@@ -0,0 +1,75 @@
+/*
+   Flux folding helpers shared by fluxWeight and rndmSample: the normalized
+   SNS flux and its variations, booking of the flux weighted histo and
+   filling it from a cross section cube, for one flux or many at once.
+*/
+
+#ifndef FLUXFOLD_H
+#define FLUXFOLD_H
+
+// C++ libraries
+#include <vector>
+
+class TDirectory;
+class TH1D;
+class TH2D;
+class XsecCube;
+class XsecTable;
+class XsecGrid;
+
+// normalized SNS flux for electron neutrinos, 0.1 MeV bins. for flux
+// variations mmu moves the decay at rest endpoint mmu/2 and tilt scales
+// the spectrum by 1 + tilt*(2x - 1), x = 2E_v/mmu, before normalizing.
+// the defaults give the standard spectrum
+TH1D *SNSflux(const char *name = "SNSflux", double mmu = 105.66837, double tilt = 0);
+
+// read normalized fluxes from a text file, one line per E_v:
+//   E_v flux_1 flux_2 ... flux_K
+// E_v are bin centers (MeV) on the 0.1 MeV grid from 0.05, every bin
+// from the first to the last E_v given exactly once, lines starting
+// with # are skipped. appends K histos named flux_<k>, k counting on
+// from the fluxes already in the list (from 1 for an empty list).
+// returns false if the file can't be read, has no flux columns or E_v
+// off the grid, repeated or missing
+bool ReadFluxes(const char *path, std::vector<TH1D*> &fluxes);
+
+// max E_v of the fold (assumes last bin in flux plt gives max Enu)
+double FluxEnumax(const TH1D *flux);
+
+// book empty flux weighted histo on the binning of the cross section
+// histos, with the E_e axis cut at the kinematic endpoint Enumax - 1.44
+TH2D *BookFluxW(const char *name, const char *title, double Enumax,
+		int nbinsx, double xmin, double xmax, int nbinsy, double ymin, double ymax);
+
+// book empty fluxW for flux range Enumax and load the cube up to Enumax
+// with the E_e bins of fluxW, from table if given (interpolated on
+// demand), else from grid if given, else from the v<E_v> histos in dir.
+// a grid gives its interpolated slices if it has every one up to Enumax,
+// else slices interpolated on demand from its tabulated ones, so all -x
+// options read a grid file the same way. returns 0 on failure
+TH2D *BookFluxCube(XsecCube &cube, TDirectory *dir, XsecTable *table, const XsecGrid *grid,
+		   double Enumax, const char *name, const char *title);
+
+// same for a set of fluxes: one empty fluxW_<k> per flux_<k> (k from 1),
+// each cut at the endpoint of its flux, and the cube loaded once up to the
+// largest. returns false on failure
+bool BookFluxCubes(XsecCube &cube, TDirectory *dir, XsecTable *table, const XsecGrid *grid,
+		   const std::vector<TH1D*> &fluxes, std::vector<TH2D*> &fluxW);
+
+// flux of every cube slice, from the bin of flux holding its E_v
+void SliceFlux(const XsecCube &cube, TH1D *flux, std::vector<double> &fluxv);
+
+// fold flux with all cube slices and fill fluxW, the cube must keep
+// exactly the E_e bins of fluxW
+void FoldFlux(const XsecCube &cube, TH1D *flux, double Enumax, TH2D *fluxW);
+
+// fold every flux in one pass over the cube and fill fluxW[k] from
+// flux[k], with the normalization FluxEnumax(flux[k]). same results as
+// separate FoldFlux calls, the cube must cover the largest fluxW
+void FoldFluxes(const XsecCube &cube, const std::vector<TH1D*> &flux, const std::vector<TH2D*> &fluxW);
+
+// book and fill fluxW from cross sections interpolated on demand from the
+// tabulated histos, without any intermediate file. returns 0 on failure
+TH2D *FoldFluxTables(XsecTable &table, TH1D *flux, int nThreads);
+
+#endif
@@ -0,0 +1,44 @@
+/*
+   Reader for the scraped Gudkov double differential cross section tables
+   (see diffscraper.py and diff2poly.C for the file structure).
+
+   Parses a whole file from memory with a hand written number parser that
+   gives the same values as the sscanf/pow code diff2poly used before,
+   without any allocation per line. Cross sections are converted to
+   d^2sigma / dE_e dcos_theta (cm^2/MeV, scaled by 10^50) and E_e to
+   kinetic energy, exactly as diff2poly always has.
+*/
+
+#ifndef GUDKOVTABLE_H
+#define GUDKOVTABLE_H
+
+// C++ libraries
+#include <string>
+#include <vector>
+
+// one data line of a table
+struct GudkovEntry
+{
+  int   theta;      // theta (deg)
+  float cos_theta;  // cos(theta)
+  float E_e;        // electron kinetic energy (MeV)
+  float p_e;        // electron momentum (MeV)
+  float diff2;      // d^2sigma/dE_edcos_theta (cm^2/MeV * 10^50)
+};
+
+struct GudkovTable
+{
+  std::string name;                  // file name without extension, eg "v12_5"
+  float E_v;                         // neutrino energy (MeV)
+  float E_hi;                        // just above max E_e, upper edge for binning
+  std::vector<GudkovEntry> entries;  // data lines in file order
+};
+
+// parse table text of length len, returns false if E_v can't be read or
+// there are no data lines
+bool ParseGudkovTable(const char *text, long len, GudkovTable &table);
+
+// read and parse a table file, name is set from the file name
+bool ReadGudkovTable(const std::string &path, GudkovTable &table);
+
+#endif
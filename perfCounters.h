@@ -0,0 +1,86 @@
+/*
+   Lightweight counters and timers for the stages of the generation chain.
+
+   Off by default. Set the environment variable EVGEN_PERF (to anything
+   but 0) to switch them on for any of the programs, which then print a
+   summary when they exit. benchmark switches them on with -c and prints
+   them after every stage.
+
+   When off, a count or timer costs one test of a global flag. The hot
+   loops count into locals and add their totals once per call, so the
+   counters don't slow the stages down when on either. Thread safe.
+*/
+
+#ifndef PERFCOUNTERS_H
+#define PERFCOUNTERS_H
+
+// C++ libraries
+#include <atomic>
+#include <chrono>
+#include <ostream>
+
+enum PerfCounterId
+{
+  kPerfLines,         // table data lines parsed
+  kPerfFindBin,       // bin searches (resample source bins, TH1::FindBin, TH2::Fill)
+  kPerfHistLookups,   // histo bin values read (GetBinContent, slice and table reads)
+  kPerfSlicesBuilt,   // interpolated E_v slices computed
+  kPerfBinsFolded,    // slice bins multiplied into a flux weighted sum, per flux
+  kPerfEvents,        // events sampled
+  kPerfBytesWritten,  // bytes written to event, grid and ROOT files
+  kPerfNcounters
+};
+
+enum PerfTimerId
+{
+  kPerfParse,         // ParseGudkovTable
+  kPerfResample,      // ResampleTable
+  kPerfInterpolate,   // interpolated slices, interpolate and XsecTable
+  kPerfLoad,          // XsecCube::Load
+  kPerfFold,          // XsecCube::Fold and FoldMany
+  kPerfSample,        // EventSampler::Sample
+  kPerfEncode,        // EventFileWriter::Encode
+  kPerfWrite,         // file writes
+  kPerfNtimers
+};
+
+extern bool gPerfEnabled;
+extern std::atomic<long long> gPerfCounts[kPerfNcounters];
+
+inline bool PerfEnabled() { return gPerfEnabled; }
+void PerfEnable(bool on);
+
+inline void PerfCount(PerfCounterId id, long long n = 1)
+{
+  if (gPerfEnabled) gPerfCounts[id].fetch_add(n, std::memory_order_relaxed);
+}
+
+long long PerfGetCount(PerfCounterId id);
+double PerfGetTime(PerfTimerId id);  // summed over calls and threads (s)
+long long PerfGetCalls(PerfTimerId id);
+
+// zero all counters and timers
+void PerfReset();
+
+// nonzero counters and timers, one per line
+void PerfPrint(std::ostream &out);
+
+// adds the time between construction and destruction to a timer
+class PerfTimer
+{
+ public:
+  explicit PerfTimer(PerfTimerId id) : fId(id), fOn(gPerfEnabled)
+  {
+    if (fOn) fStart = std::chrono::steady_clock::now();
+  }
+  ~PerfTimer() { if (fOn) Stop(); }
+
+ private:
+  void Stop();
+
+  PerfTimerId fId;
+  bool fOn;
+  std::chrono::steady_clock::time_point fStart;
+};
+
+#endif
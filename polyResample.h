@@ -0,0 +1,40 @@
+/*
+   Resampling of a parsed Gudkov table onto a regular (E_e, cos_theta) grid.
+
+   The table has its own E_e points in every theta row. Each point becomes a
+   bin reaching halfway to its neighbours, like the TH2Poly bins diff2poly
+   used to build. Every target row maps to one theta row, and within it the
+   sorted source and target E_e edges are walked together. A whole table
+   therefore resamples in time linear in the number of source and target
+   bins, with no histo lookups.
+
+   The fill and interpolation rules are the ones of the old TH2Poly FindBin
+   loop, including its bin edge conventions: a source bin holds
+   x1 < E_e <= x2, and E_e = 0 falls outside all bins. Works for any target
+   binning and is thread safe.
+*/
+
+#ifndef POLYRESAMPLE_H
+#define POLYRESAMPLE_H
+
+// C++ libraries
+#include <vector>
+
+struct GudkovTable;
+
+// regular target binning, defaults to the standard 1695 x 100 grid
+struct ResampleBinning
+{
+  int nbinsx;
+  double xmin, xmax;
+  int nbinsy;
+  double ymin, ymax;
+
+  ResampleBinning() : nbinsx(1695), xmin(0.5), xmax(170), nbinsy(100), ymin(-1.01), ymax(1.01) {}
+};
+
+// resample table onto binning, values are indexed (ybin-1)*nbinsx + (xbin-1).
+// a table without entries or with no E_e above 0 gives all zeros
+void ResampleTable(const GudkovTable &table, const ResampleBinning &binning, std::vector<double> &values);
+
+#endif
@@ -0,0 +1,52 @@
+/*
+   Per event weights for samples drawn from the joint (E_v, E_e, cos_theta)
+   distribution (rndmSample -e).
+
+   An event from slice v and bin b was drawn with probability
+   proportional to xsec[v][b] * flux[v] * binsize[v]. For an alternative
+   flux, and optionally alternative cross sections on the same slices and
+   bins, its weight is the ratio of the normalized new and old
+   probabilities. The ratios are computed once for every slice (flux) and
+   bin (cross sections), so weighting an event is two lookups. Weights
+   average to 1 over a large sample, except where the new inputs are
+   nonzero but the old ones were 0, since the sample has no events there.
+*/
+
+#ifndef RATIOTABLE_H
+#define RATIOTABLE_H
+
+// C++ libraries
+#include <vector>
+
+class XsecCube;
+
+class RatioTable
+{
+ public:
+  RatioTable();
+
+  // ratios from the cube and flux per slice the sample was drawn with to
+  // fluxNew and, if given, the cross sections of cubeNew, which must have
+  // the slices and bins of cube. returns false if they don't match or a
+  // distribution is empty
+  bool Build(const XsecCube &cube, const double *flux, const double *fluxNew,
+	     const XsecCube *cubeNew = 0);
+
+  // slice with E_v on the 0.1 MeV grid, -1 if there is none
+  int FindSlice(double E_v) const;
+
+  // weight of an event from E_v slice and bin (xbin, ybin from 1),
+  // 0 outside the table
+  double Weight(double E_v, int xbin, int ybin) const;
+
+  int GetNslices() const { return fSliceRatio.size(); }
+
+ private:
+  int fNbinsX, fNbinsY;
+  long fTenthsMin;                  // E_v of the first slice in 0.1 MeV units
+  std::vector<int> fSlices;         // slice for E_v tenths from fTenthsMin, -1 if none
+  std::vector<double> fSliceRatio;  // normalized flux ratio of each slice
+  std::vector<float> fXsecRatio;    // [slice][ybin][xbin] cross section ratio, empty if unchanged
+};
+
+#endif
@@ -0,0 +1,52 @@
+/*
+   Counter based random number stream.
+
+   Each draw is a SplitMix64 hash of (key + counter * golden gamma), so a
+   stream can jump to any position in O(1) and streams keyed by
+   (seed, stream id) are independent. Used to give every block of events
+   its own stream, which keeps samples identical for any thread count.
+*/
+
+#ifndef RNDMSTREAM_H
+#define RNDMSTREAM_H
+
+// C++ libraries
+#include <stdint.h>
+
+class RndmStream
+{
+ public:
+  RndmStream(uint64_t seed = 0, uint64_t stream = 0) { SetSeed(seed, stream); }
+
+  // select stream and rewind to its start
+  void SetSeed(uint64_t seed, uint64_t stream)
+  {
+    fKey = Mix(seed + Mix(stream + kGamma));
+    fCounter = 0;
+  }
+
+  // jump to the n-th draw of the current stream
+  void Seek(uint64_t n) { fCounter = n; }
+  uint64_t Tell() const { return fCounter; }
+
+  // next 64 random bits
+  uint64_t Next() { return Mix(fKey + (++fCounter) * kGamma); }
+
+  // uniform double in [0,1) with 53 random bits
+  double Rndm() { return (Next() >> 11) * (1.0 / 9007199254740992.0); }
+
+ private:
+  static const uint64_t kGamma = 0x9e3779b97f4a7c15ULL;
+
+  static uint64_t Mix(uint64_t z)
+  {
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+  }
+
+  uint64_t fKey;
+  uint64_t fCounter;
+};
+
+#endif
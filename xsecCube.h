@@ -0,0 +1,113 @@
+/*
+   Dense in-memory cube of double differential cross sections.
+
+   Loads the v<E_v> TH2D histos written by diff2poly/interpolate into one
+   contiguous E_v x cos_theta x E_e array of doubles (E_e fastest, same
+   ordering as the TH2D bins). Once loaded, flux folding is a flat
+   reduction over slices that is split across threads by bin range, so
+   every bin still sums its E_v terms in the original order and the
+   result is bit-identical to the histo-by-histo loop.
+*/
+
+#ifndef XSECCUBE_H
+#define XSECCUBE_H
+
+// C++ libraries
+#include <cmath>
+#include <map>
+#include <string>
+#include <vector>
+
+class TDirectory;
+class TKey;
+class TH2D;
+class XsecTable;
+class XsecGrid;
+
+class XsecCube
+{
+ public:
+  XsecCube();
+
+  // histo name for a given E_v, eg 12.3 -> "v12_3"
+  static std::string SliceName(double E_v);
+
+  // E_v in 0.1 MeV units, the key slices are matched by everywhere
+  static long Tenths(double E_v) { return std::floor(E_v*10 + 0.5); }
+
+  // E_v of a histo name, eg "v12_5" -> 12.5. false unless name is the
+  // SliceName of an E_v on the 0.1 MeV grid
+  static bool SliceEnu(const std::string &name, double &E_v);
+
+  // keys of all v<E_v> TH2Ds in dir by Tenths(E_v). keys are listed newest
+  // cycle first, only the newest of every name is kept
+  static void SliceKeys(TDirectory *dir, std::map<long, TKey*> &keys);
+
+  // first nbinsx E_e bins of every row of hist, without under/overflow,
+  // indexed (ybin-1)*nbinsx + (xbin-1) as XsecGrid::CopySlice
+  static void CopyBins(const TH2D *hist, double *out, int nbinsx);
+
+  // true if the axes of the slice at E_v are the expected ones, else
+  // prints both. slices of one set must agree in bins and ranges
+  static bool CheckBinning(double E_v, int nbinsx, double xmin, double xmax, int nbinsy, double ymin, double ymax,
+			   int expNbinsx, double expXmin, double expXmax, int expNbinsy, double expYmin, double expYmax);
+
+  // load slices E_v = EnuMin, EnuMin+EnuStep, ... while E_v < EnuMax,
+  // keeping the first nbinsx E_e bins (nbinsx <= 0 keeps all of them).
+  // E_v is stepped by repeated addition exactly as fluxWeight always has.
+  // returns false if a histo is missing or its axes differ from the first
+  bool Load(TDirectory *dir, double EnuMin, double EnuMax, double EnuStep, int nbinsx = 0);
+
+  // same, building the slices on demand from tabulated cross sections
+  bool Load(XsecTable &table, double EnuMin, double EnuMax, double EnuStep, int nbinsx = 0);
+
+  // same, from the mapped slices of a grid file. The slices are copied
+  // on purpose: the fold and EventSampler want every row as nbinsx doubles
+  // at a fixed stride, while the grid keeps a different E_e range per
+  // slice and may store float32. What the grid saves is the ROOT I/O and
+  // histo objects, not the cube itself
+  bool Load(const XsecGrid &grid, double EnuMin, double EnuMax, double EnuStep, int nbinsx = 0);
+
+  // flux weighted sum over slices for every bin:
+  //   out[bin] = sum_v xsec[v][bin] * flux[v] * binsize[v] / norm
+  // where binsize[v] = E_v - E_v_last (the first slice uses E_v_last = 0).
+  // out has GetNbins() entries, indexed (ybin-1)*GetNbinsX() + (xbin-1)
+  void Fold(const double *flux, double norm, double *out) const;
+
+  // same for nflux fluxes in one pass over the cube: flux[k] and norm[k]
+  // give out[k]. each out[k] is identical to a separate Fold
+  void FoldMany(int nflux, const double *const *flux, const double *norm, double *const *out) const;
+
+  // number of worker threads used by Fold (0 = hardware concurrency)
+  void SetNthreads(int n) { fNthreads = n; }
+  int GetNthreads() const;
+
+  int GetNslices() const { return fNslices; }
+  int GetNbinsX() const { return fNbinsX; }
+  int GetNbinsY() const { return fNbinsY; }
+  long GetNbins() const { return (long)fNbinsX * fNbinsY; }
+  double GetEnu(int v) const { return fEnu[v]; }
+  double GetBinsize(int v) const { return fBinsize[v]; }
+  const double *GetSlice(int v) const { return &fData[v * GetNbins()]; }
+
+ private:
+  void Clear();
+  // storage of a new slice with the given axes, 0 if they don't match
+  double *AddSlice(double E_v, double binsize, int NX, double xmin, double xmax,
+		   int NY, double ymin, double ymax, int nbinsx);
+  void FoldRange(int nflux, const double *const *flux, const double *norm, double *const *out,
+		 long first, long last) const;
+
+  int fNslices;
+  int fNbinsX;
+  int fNbinsY;
+  int fNthreads;
+  int fAxisNbinsX;               // full E_e axis of the slices, of which
+  double fXmin, fXmax;           // the first fNbinsX bins are kept
+  double fYmin, fYmax;
+  std::vector<double> fEnu;      // E_v of each slice
+  std::vector<double> fBinsize;  // E_v step below each slice
+  std::vector<double> fData;     // [slice][ybin][xbin]
+};
+
+#endif
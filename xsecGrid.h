@@ -0,0 +1,135 @@
+/*
+   Binary cross section grid file.
+
+   Holds the v<E_v> double differential cross section histos of
+   diffxsections.root in one flat file that is read through mmap, so a
+   stage can use any slice straight from the page cache without reading
+   or copying the whole set first.
+
+   Layout (native little endian):
+     XsecGridHeader                 128 bytes, axes shared by all slices
+     slice data                     each slice 64 byte aligned
+     XsecGridSlice[nslices]         at header.tableOffset, sorted by E_v
+
+   Each slice stores nbinsy rows of its first nkept E_e bins only, values
+   are double or float32 for the whole file. nkept covers the kinematically
+   allowed range up to the bin holding E_e = E_v - 1.44 MeV, extended if a
+   histo has nonzero bins beyond that, so converting a file never drops a
+   value. Everything past nkept is 0.
+*/
+
+#ifndef XSECGRID_H
+#define XSECGRID_H
+
+// C++ libraries
+#include <cstdio>
+#include <vector>
+#include <stdint.h>
+
+// file header, written as is
+struct XsecGridHeader
+{
+  char     magic[8];        // "EVGNXSG"
+  uint32_t version;         // kXsecGridVersion
+  uint32_t valueSize;       // bytes per stored value, 8 (double) or 4 (float32)
+  uint64_t nslices;         // number of E_v slices
+  uint64_t tableOffset;     // file offset of the slice table
+  uint64_t fileSize;        // total file size, catches truncated files
+  int32_t  nbinsx;          // E_e axis of the full histos
+  int32_t  nbinsy;          // cos_theta axis
+  double   xmin, xmax;
+  double   ymin, ymax;
+  char     reserved[48];
+};
+
+// one entry of the slice table
+struct XsecGridSlice
+{
+  double   E_v;             // neutrino energy (MeV)
+  int32_t  nkept;           // stored E_e bins per row
+  uint32_t flags;           // kXsecGridTabulated, ...
+  uint64_t offset;          // file offset of the first row
+  uint64_t reserved;
+};
+
+const uint32_t kXsecGridVersion = 1;
+const uint32_t kXsecGridTabulated = 1;  // slice from diff2poly, not interpolate
+
+// E_e bins up to and including the one holding the kinematic endpoint
+// E_v - 1.44 MeV, on a fixed axis as TAxis::FindBin finds it
+int XsecGridEndpointBins(double E_v, int nbinsx, double xmin, double xmax);
+
+class XsecGrid
+{
+ public:
+  XsecGrid();
+  ~XsecGrid();
+
+  // map a grid file, returns false if it is missing or not a valid grid
+  bool Open(const char *path);
+  void Close();
+
+  int GetNslices() const { return fHeader ? fHeader->nslices : 0; }
+  int GetNbinsX() const { return fHeader->nbinsx; }
+  int GetNbinsY() const { return fHeader->nbinsy; }
+  double GetXmin() const { return fHeader->xmin; }
+  double GetXmax() const { return fHeader->xmax; }
+  double GetYmin() const { return fHeader->ymin; }
+  double GetYmax() const { return fHeader->ymax; }
+  bool IsFloat() const { return fHeader->valueSize == sizeof(float); }
+
+  double GetEnu(int s) const { return fSlices[s].E_v; }
+  bool IsTabulated(int s) const { return fSlices[s].flags & kXsecGridTabulated; }
+  int GetNkept(int s) const { return fSlices[s].nkept; }
+
+  // slice at E_v on the 0.1 MeV grid, -1 if there is none
+  int FindSlice(double E_v) const;
+
+  // stored part of row ybin (1..nbinsy) of slice s, GetNkept(s) values.
+  // points into the mapping, 0 if the file has the other value type
+  const double *GetRow(int s, int ybin) const;
+  const float *GetRowFloat(int s, int ybin) const;
+
+  // single bin, 0 past the stored range
+  double GetValue(int s, int xbin, int ybin) const;
+
+  // first nbinsx E_e bins of every row as doubles, indexed
+  // (ybin-1)*nbinsx + (xbin-1), zero filled past the stored range
+  void CopySlice(int s, double *out, int nbinsx) const;
+
+ private:
+  const char *fData;
+  uint64_t fSize;
+  const XsecGridHeader *fHeader;
+  const XsecGridSlice *fSlices;
+};
+
+class XsecGridWriter
+{
+ public:
+  XsecGridWriter();
+  ~XsecGridWriter();
+
+  // create grid file for histos with the given axes
+  bool Open(const char *path, bool useFloat, int nbinsx, double xmin, double xmax,
+	    int nbinsy, double ymin, double ymax);
+
+  // append one slice, nbinsx*nbinsy values indexed (ybin-1)*nbinsx + (xbin-1).
+  // slices must be added in increasing E_v
+  bool AddSlice(double E_v, bool tabulated, const double *values);
+
+  // write slice table and header, returns false on any write error
+  bool Close();
+
+ private:
+  bool Pad();
+
+  FILE *fFile;
+  XsecGridHeader fHeader;
+  std::vector<XsecGridSlice> fSlices;
+  std::vector<char> fRow;     // one converted row
+  uint64_t fPos;
+  bool fOk;
+};
+
+#endif
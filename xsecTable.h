@@ -0,0 +1,92 @@
+/*
+   On-demand interpolated double differential cross sections.
+
+   Keeps only the tabulated E_v slices written by diff2poly and builds the
+   slices in between when asked, using the same energy shifted linear
+   interpolation as interpolate.C: between tabulated E_v1 < E_v2 the slice
+   at E_v1 + i*0.1 MeV takes E_e bins shifted down by (E_v - E_v1) from the
+   E_v1 slice and up by (E_v2 - E_v) from the E_v2 slice, so the kinematic
+   endpoint moves with E_v. Results are bit-identical to the histos
+   interpolate writes.
+
+   E_v is handled on the 0.1 MeV grid interpolate produces, queries are
+   rounded to it. Built slices go into a bounded LRU cache. Not thread safe.
+*/
+
+#ifndef XSECTABLE_H
+#define XSECTABLE_H
+
+// C++ libraries
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+class TDirectory;
+class XsecGrid;
+
+class XsecTable
+{
+ public:
+  typedef std::shared_ptr<const std::vector<double> > Slice;
+
+  // cacheSize = number of interpolated slices kept in memory
+  XsecTable(int cacheSize = 16);
+
+  // read all tabulated (not interpolated) v<E_v> histos from dir
+  bool Load(TDirectory *dir);
+
+  // same, from the tabulated slices of a grid file
+  bool Load(const XsecGrid &grid);
+
+  // add one tabulated slice, nbinsx*nbinsy values indexed [ybin][xbin],
+  // all slices must share the bins and axis ranges of the first one added
+  bool AddTable(double E_v, const double *values, int nbinsx, double xmin, double xmax,
+		int nbinsy, double ymin, double ymax);
+
+  // whole slice at E_v, nbinsx*nbinsy values indexed (ybin-1)*nbinsx + (xbin-1),
+  // null outside the tabulated E_v range
+  Slice GetSlice(double E_v);
+
+  // single cross section value, 0 outside the tabulated range
+  double Eval(double E_v, double E_e, double cos_theta) const;
+
+  int GetNtables() const { return fTables.size(); }
+  double GetEnuMin() const;
+  double GetEnuMax() const;
+
+  int GetNbinsX() const { return fNbinsX; }
+  int GetNbinsY() const { return fNbinsY; }
+  double GetXmin() const { return fXmin; }
+  double GetXmax() const { return fXmax; }
+  double GetYmin() const { return fYmin; }
+  double GetYmax() const { return fYmax; }
+
+  // number of slices built since construction
+  long GetNbuilt() const { return fNbuilt; }
+
+ private:
+  typedef std::map<long, Slice> TableMap;
+
+  // tabulated slices below and above E_v (in 0.1 MeV units)
+  bool FindGap(long tenths, TableMap::const_iterator &lo, TableMap::const_iterator &hi) const;
+  // E_v spacing of a gap given in 0.1 MeV units
+  static float Spacing(long gap);
+  // one interpolated bin, exactly as interpolate.C computes it
+  double Cell(const std::vector<double> &hist1, const std::vector<double> &hist2,
+	      int i, float EnuSpacing, int NumInterps, int xbin, int ybin) const;
+
+  int fNbinsX, fNbinsY;
+  double fXmin, fXmax, fYmin, fYmax;
+  float fBinsize;
+
+  TableMap fTables;  // tabulated slices keyed by E_v in 0.1 MeV units
+
+  // LRU cache of built slices, most recent first
+  int fCacheSize;
+  std::list<std::pair<long, Slice> > fCache;
+  long fNbuilt;
+};
+
+#endif